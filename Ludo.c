@@ -4,10 +4,10 @@
  * ルドーゲーム - 完成版 v1.0 (オフライン専用)
  *
  * このコードは、ルドーの主要なゲームルールを実装した安定版です。
- * オンライン機能を廃止し、4人でのオフライン対戦に特化しています。
+ * オンライン機能を廃止し、2〜6人でのオフライン対戦に特化しています。
  *
  * 主な機能:
- * - 4人でのオフライン対戦
+ * - 2〜6人でのオフライン対戦 (ゲーム開始時に盤面バリアントを選択)
  * - 追い出し(キャプチャー)処理
  * - ホームストレッチへの進入と移動
  * - ゴール、勝利判定、結果表示
@@ -30,22 +30,28 @@
 #include <stdbool.h>
 
 // --- 定数定義 ---
-#define BOARD_H 31
-#define BOARD_W 65 // 65
-#define PATH_LENGTH 52
-#define HOME_STRETCH_LENGTH 6
+#define CELL_H 2 // 1マスの高さ (行)
+#define CELL_W 4 // 1マスの幅 (桁)
+#define MAX_PLAYERS 6
+#define CLASSIC_PATH_LENGTH 52
+#define CLASSIC_HOME_LENGTH 6
+#define RING_PATH_LENGTH 60
+#define RING_HOME_LENGTH 5
 #define GOAL_POSITION 999
 #define DEBUG_MODE 1
 
 // --- 列挙型定義 ---
 typedef enum {
     MENU_ITEM_START_GAME, MENU_ITEM_RULES, MENU_ITEM_EXIT, MENU_ITEM_BACK,
+    MENU_ITEM_VARIANT_2P, MENU_ITEM_VARIANT_3P, MENU_ITEM_VARIANT_4P,
+    MENU_ITEM_VARIANT_5P, MENU_ITEM_VARIANT_6P,
     MENU_ITEM_ROLL_DICE, BOARD_CLICK, MENU_ITEM_NONE
 } MenuSelection;
 
 typedef enum {
     C_NONE, C_RED, C_GREEN, C_YELLOW, C_BLUE,
-    C_PATH, C_GOAL, C_GRID, C_PANEL_BG
+    C_PATH, C_GOAL, C_GRID, C_PANEL_BG,
+    C_CYAN, C_MAGENTA
 } CellColor;
 
 // --- 構造体定義 ---
@@ -76,8 +82,30 @@ typedef enum {
     STATE_ROLLING, STATE_MOVING_PIECE, STATE_GAME_OVER
 } TurnPhase;
 
+/**
+ * 盤面バリアント
+ * 人数・周回路の長さ・ホームストレッチの長さごとに、盤面の座標テーブルと
+ * ルール関数をコンパイル時に生成しておき、ゲーム開始時に1つ選択する。
+ * 駒の位置はすべて各プレイヤーのスタート地点からの相対位置で持つ。
+ */
+typedef struct {
+    const char *name;
+    int num_players;
+    int home_stretch_length;
+    int rows, cols;               // 盤面のマス数
+    const CellColor *seat_colors; // [num_players]
+    const int *layout;            // [rows * cols] 各マスの色 (C_NONE は空白)
+    const Point (*base_map)[4];   // [num_players][4]
+    const Point *path_map;        // 絶対位置 -> 座標
+    const Point *home_map;        // [num_players * home_stretch_length]
+    int  (*absolutePos)(int relative_pos, int seat);
+    bool (*isMovable)(int position, int dice);
+    int  (*advance)(int position, int dice);
+} BoardVariant;
+
 typedef struct {
-    Player players[4];
+    const BoardVariant *variant;
+    Player players[MAX_PLAYERS];
     int num_players;
     int current_turn_idx;
     int dice_value;
@@ -90,13 +118,236 @@ typedef struct {
 // --- グローバル盤面データ ---
 const char* PIECE_SYMBOLS[] = {"1", "2", "3", "4"};
 
+/**
+ * ルール関数をバリアントごとに特殊化して生成する。
+ * 周回路・ホームストレッチの長さとスタート地点の間隔がコンパイル時定数になるため、
+ * 剰余や境界判定はすべて定数畳み込みされる。
+ * ホームストレッチへの進入マスは全プレイヤー共通で相対位置 PATH_LEN - 2。
+ * ホームストレッチを越える目では動かせない (ちょうどの目でゴール)。
+ */
+#define DEFINE_BOARD_RULES(name, PATH_LEN, HOME_LEN, SEAT_STRIDE) \
+    _Static_assert((HOME_LEN) < 100, #name ": home stretch too long"); \
+    enum { name##_PATH_LEN = (PATH_LEN), name##_HOME_LEN = (HOME_LEN), name##_SEAT_STRIDE = (SEAT_STRIDE) }; \
+    static int name##_absolutePos(int relative_pos, int seat) { \
+        return (relative_pos + seat * (SEAT_STRIDE)) % (PATH_LEN); \
+    } \
+    static bool name##_isMovable(int position, int dice) { \
+        if (position == GOAL_POSITION) return false; \
+        if (position == -1) return dice == 6; \
+        if (position >= 100) return position % 100 + dice <= (HOME_LEN); \
+        return position + dice - ((PATH_LEN) - 1) <= (HOME_LEN); \
+    } \
+    static int name##_advance(int position, int dice) { \
+        if (position == -1) return 0; \
+        if (position >= 100) { \
+            return (position % 100 + dice == (HOME_LEN)) ? GOAL_POSITION : position + dice; \
+        } \
+        if (position <= (PATH_LEN) - 2 && position + dice > (PATH_LEN) - 2) { \
+            int remaining_move = dice - ((PATH_LEN) - 1 - position); \
+            return (remaining_move == (HOME_LEN)) ? GOAL_POSITION : 100 + remaining_move; \
+        } \
+        return (position + dice) % (PATH_LEN); \
+    }
+
+#define BOARD_VARIANT(label, rules, colors, layout, base, path, home) \
+    { label, sizeof(colors) / sizeof(colors[0]), \
+      sizeof(home[0]) / sizeof(home[0][0]), \
+      sizeof(layout) / sizeof(layout[0]), sizeof(layout[0]) / sizeof(layout[0][0]), \
+      colors, &layout[0][0], base, path, &home[0][0], \
+      rules##_absolutePos, rules##_isMovable, rules##_advance }
+
+DEFINE_BOARD_RULES(classic2, CLASSIC_PATH_LENGTH, CLASSIC_HOME_LENGTH, 26)
+DEFINE_BOARD_RULES(classic4, CLASSIC_PATH_LENGTH, CLASSIC_HOME_LENGTH, 13)
+DEFINE_BOARD_RULES(ring5, RING_PATH_LENGTH, RING_HOME_LENGTH, 12)
+DEFINE_BOARD_RULES(ring6, RING_PATH_LENGTH, RING_HOME_LENGTH, 10)
+
+// クラシック盤面 (15x15, 2〜4人)
+static const int CLASSIC4_LAYOUT[15][15] = {
+    {1,1,1,1,1,1, 5,5,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
+    {5,1,1,1,1,1, 6,6,6, 3,3,3,3,3,5},
+    {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
+    {4,4,4,4,4,4, 5,4,5, 3,3,3,3,3,3},
+    {4,4,4,4,4,4, 5,4,5, 3,3,3,3,3,3},
+    {4,4,4,4,4,4, 5,4,5, 3,3,3,3,3,3},
+    {4,4,4,4,4,4, 5,4,5, 3,3,3,3,3,3},
+    {4,4,4,4,4,4, 5,4,5, 3,3,3,3,3,3},
+    {4,4,4,4,4,4, 5,5,5, 3,3,3,3,3,3},
+};
+static const Point CLASSIC_PATH_MAP[CLASSIC_PATH_LENGTH] = {
+    {6,1},{6,2},{6,3},{6,4},{6,5}, {5,6},{4,6},{3,6},{2,6},{1,6},{0,6},
+    {0,7}, {0,8},{1,8},{2,8},{3,8},{4,8},{5,8}, {6,9},{6,10},{6,11},{6,12},{6,13},{6,14},
+    {7,14}, {8,14},{8,13},{8,12},{8,11},{8,10},{8,9}, {9,8},{10,8},{11,8},{12,8},{13,8},{14,8},
+    {14,7}, {14,6},{13,6},{12,6},{11,6},{10,6},{9,6}, {8,5},{8,4},{8,3},{8,2},{8,1},{8,0},
+    {7,0}, {6,0}
+};
+#define CLASSIC_BASE_RED    {{1,1},{1,4},{4,1},{4,4}}
+#define CLASSIC_BASE_GREEN  {{1,10},{1,13},{4,10},{4,13}}
+#define CLASSIC_BASE_YELLOW {{10,10},{10,13},{13,10},{13,13}}
+#define CLASSIC_BASE_BLUE   {{10,1},{10,4},{13,1},{13,4}}
+#define CLASSIC_HOME_RED    {{7,1},{7,2},{7,3},{7,4},{7,5},{7,6}}
+#define CLASSIC_HOME_GREEN  {{1,7},{2,7},{3,7},{4,7},{5,7},{6,7}}
+#define CLASSIC_HOME_YELLOW {{7,13},{7,12},{7,11},{7,10},{7,9},{7,8}}
+#define CLASSIC_HOME_BLUE   {{13,7},{12,7},{11,7},{10,7},{9,7},{8,7}}
+
+// 2人対戦は対角の赤・黄を使い、緑・青の陣地は空白にする
+static const CellColor CLASSIC2_COLORS[] = {C_RED, C_YELLOW};
+static const int CLASSIC2_LAYOUT[15][15] = {
+    {1,1,1,1,1,1, 5,5,5, 0,0,0,0,0,0},
+    {1,1,1,1,1,1, 5,0,5, 0,0,0,0,0,0},
+    {1,1,1,1,1,1, 5,0,5, 0,0,0,0,0,0},
+    {1,1,1,1,1,1, 5,0,5, 0,0,0,0,0,0},
+    {1,1,1,1,1,1, 5,0,5, 0,0,0,0,0,0},
+    {1,1,1,1,1,1, 5,0,5, 0,0,0,0,0,0},
+    {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
+    {5,1,1,1,1,1, 6,6,6, 3,3,3,3,3,5},
+    {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,5,5, 3,3,3,3,3,3},
+};
+static const Point CLASSIC2_BASE_MAP[2][4] = {CLASSIC_BASE_RED, CLASSIC_BASE_YELLOW};
+static const Point CLASSIC2_HOME_MAP[2][CLASSIC_HOME_LENGTH] = {CLASSIC_HOME_RED, CLASSIC_HOME_YELLOW};
+
+// 3人対戦は青の陣地を空白にする
+static const CellColor CLASSIC3_COLORS[] = {C_RED, C_GREEN, C_YELLOW};
+static const int CLASSIC3_LAYOUT[15][15] = {
+    {1,1,1,1,1,1, 5,5,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
+    {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
+    {5,1,1,1,1,1, 6,6,6, 3,3,3,3,3,5},
+    {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,0,5, 3,3,3,3,3,3},
+    {0,0,0,0,0,0, 5,5,5, 3,3,3,3,3,3},
+};
+static const Point CLASSIC3_BASE_MAP[3][4] = {CLASSIC_BASE_RED, CLASSIC_BASE_GREEN, CLASSIC_BASE_YELLOW};
+static const Point CLASSIC3_HOME_MAP[3][CLASSIC_HOME_LENGTH] = {CLASSIC_HOME_RED, CLASSIC_HOME_GREEN, CLASSIC_HOME_YELLOW};
+
+static const CellColor CLASSIC4_COLORS[] = {C_RED, C_GREEN, C_YELLOW, C_BLUE};
+static const Point CLASSIC4_BASE_MAP[4][4] = {
+    CLASSIC_BASE_RED, CLASSIC_BASE_GREEN, CLASSIC_BASE_YELLOW, CLASSIC_BASE_BLUE
+};
+static const Point CLASSIC4_HOME_MAP[4][CLASSIC_HOME_LENGTH] = {
+    CLASSIC_HOME_RED, CLASSIC_HOME_GREEN, CLASSIC_HOME_YELLOW, CLASSIC_HOME_BLUE
+};
+
+// リング盤面 (13x19, 5〜6人) 外周60マスを時計回りに周回する
+static const Point RING_PATH_MAP[RING_PATH_LENGTH] = {
+    {0,1},{0,2},{0,3},{0,4},{0,5},{0,6},{0,7},{0,8},{0,9},{0,10},
+    {0,11},{0,12},{0,13},{0,14},{0,15},{0,16},{0,17},{0,18},{1,18},{2,18},
+    {3,18},{4,18},{5,18},{6,18},{7,18},{8,18},{9,18},{10,18},{11,18},{12,18},
+    {12,17},{12,16},{12,15},{12,14},{12,13},{12,12},{12,11},{12,10},{12,9},{12,8},
+    {12,7},{12,6},{12,5},{12,4},{12,3},{12,2},{12,1},{12,0},{11,0},{10,0},
+    {9,0},{8,0},{7,0},{6,0},{5,0},{4,0},{3,0},{2,0},{1,0},{0,0}
+};
+
+static const CellColor RING5_COLORS[] = {C_RED, C_GREEN, C_YELLOW, C_BLUE, C_CYAN};
+static const int RING5_LAYOUT[13][19] = {
+    {5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+    {5,1,1,1,1,1,0,0,0,0,0,2,0,0,0,0,0,0,5},
+    {5,1,1,0,0,0,0,0,0,0,0,2,0,2,2,0,0,0,5},
+    {5,1,1,0,0,0,0,0,0,0,0,2,0,2,2,0,0,0,5},
+    {5,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,5},
+    {5,0,0,0,0,0,0,0,0,0,0,2,0,3,3,3,3,3,5},
+    {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5},
+    {5,9,0,0,0,0,0,0,0,0,0,0,0,4,0,3,3,0,5},
+    {5,9,0,0,0,0,0,0,0,0,0,0,0,4,0,3,3,0,5},
+    {5,9,0,0,0,0,0,0,0,0,4,4,0,4,0,0,0,0,5},
+    {5,9,9,9,0,0,0,0,0,0,4,4,0,4,0,0,0,0,5},
+    {5,9,9,9,0,0,0,0,0,0,0,0,0,4,0,0,0,0,5},
+    {5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+};
+static const Point RING5_BASE_MAP[5][4] = {
+    {{2,1},{2,2},{3,1},{3,2}}, {{2,13},{2,14},{3,13},{3,14}}, {{7,16},{8,16},{7,15},{8,15}},
+    {{10,11},{10,10},{9,11},{9,10}}, {{11,2},{10,2},{11,3},{10,3}}
+};
+static const Point RING5_HOME_MAP[5][RING_HOME_LENGTH] = {
+    {{1,1},{1,2},{1,3},{1,4},{1,5}}, {{1,11},{2,11},{3,11},{4,11},{5,11}},
+    {{5,17},{5,16},{5,15},{5,14},{5,13}}, {{11,13},{10,13},{9,13},{8,13},{7,13}},
+    {{11,1},{10,1},{9,1},{8,1},{7,1}}
+};
+
+static const CellColor RING6_COLORS[] = {C_RED, C_GREEN, C_YELLOW, C_BLUE, C_CYAN, C_MAGENTA};
+static const int RING6_LAYOUT[13][19] = {
+    {5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+    {5,1,1,1,1,1,0,0,0,2,0,0,0,3,3,3,3,3,5},
+    {5,1,1,0,0,0,0,0,0,2,0,2,2,0,0,0,0,0,5},
+    {5,1,1,0,0,0,0,0,0,2,0,2,2,0,0,3,3,0,5},
+    {5,0,0,0,0,0,0,0,0,2,0,0,0,0,0,3,3,0,5},
+    {5,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,5},
+    {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5},
+    {5,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,5},
+    {5,0,10,10,0,0,0,0,0,9,0,0,0,0,0,0,0,0,5},
+    {5,0,10,10,0,0,9,9,0,9,0,0,0,0,0,0,4,4,5},
+    {5,0,0,0,0,0,9,9,0,9,0,0,0,0,0,0,4,4,5},
+    {5,10,10,10,10,10,0,0,0,9,0,0,0,4,4,4,4,4,5},
+    {5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+};
+static const Point RING6_BASE_MAP[6][4] = {
+    {{2,1},{2,2},{3,1},{3,2}}, {{2,11},{2,12},{3,11},{3,12}}, {{3,16},{4,16},{3,15},{4,15}},
+    {{10,17},{10,16},{9,17},{9,16}}, {{10,7},{10,6},{9,7},{9,6}}, {{9,2},{8,2},{9,3},{8,3}}
+};
+static const Point RING6_HOME_MAP[6][RING_HOME_LENGTH] = {
+    {{1,1},{1,2},{1,3},{1,4},{1,5}}, {{1,9},{2,9},{3,9},{4,9},{5,9}},
+    {{1,17},{1,16},{1,15},{1,14},{1,13}}, {{11,17},{11,16},{11,15},{11,14},{11,13}},
+    {{11,9},{10,9},{9,9},{8,9},{7,9}}, {{11,1},{11,2},{11,3},{11,4},{11,5}}
+};
+
+// ルール関数と座標テーブルの長さ・人数が食い違っていないかをコンパイル時に確認する
+#define CHECK_BOARD_VARIANT(rules, colors, base, path, home) \
+    _Static_assert(sizeof(path) / sizeof(path[0]) == rules##_PATH_LEN, #path ": path length does not match " #rules); \
+    _Static_assert(sizeof(home[0]) / sizeof(home[0][0]) == rules##_HOME_LEN, #home ": home stretch length does not match " #rules); \
+    _Static_assert(sizeof(base) / sizeof(base[0]) == sizeof(colors) / sizeof(colors[0]) && \
+                   sizeof(home) / sizeof(home[0]) == sizeof(colors) / sizeof(colors[0]), #colors ": seat count does not match table rows"); \
+    _Static_assert(sizeof(colors) / sizeof(colors[0]) * rules##_SEAT_STRIDE <= rules##_PATH_LEN, #colors ": seat starts do not fit on the path")
+
+CHECK_BOARD_VARIANT(classic2, CLASSIC2_COLORS, CLASSIC2_BASE_MAP, CLASSIC_PATH_MAP, CLASSIC2_HOME_MAP);
+CHECK_BOARD_VARIANT(classic4, CLASSIC3_COLORS, CLASSIC3_BASE_MAP, CLASSIC_PATH_MAP, CLASSIC3_HOME_MAP);
+CHECK_BOARD_VARIANT(classic4, CLASSIC4_COLORS, CLASSIC4_BASE_MAP, CLASSIC_PATH_MAP, CLASSIC4_HOME_MAP);
+CHECK_BOARD_VARIANT(ring5, RING5_COLORS, RING5_BASE_MAP, RING_PATH_MAP, RING5_HOME_MAP);
+CHECK_BOARD_VARIANT(ring6, RING6_COLORS, RING6_BASE_MAP, RING_PATH_MAP, RING6_HOME_MAP);
+
+// メニューの並び順 (MENU_ITEM_VARIANT_2P〜6P) と一致させること
+static const BoardVariant BOARD_VARIANTS[] = {
+    BOARD_VARIANT("2人対戦", classic2, CLASSIC2_COLORS, CLASSIC2_LAYOUT,
+                  CLASSIC2_BASE_MAP, CLASSIC_PATH_MAP, CLASSIC2_HOME_MAP),
+    BOARD_VARIANT("3人対戦", classic4, CLASSIC3_COLORS, CLASSIC3_LAYOUT,
+                  CLASSIC3_BASE_MAP, CLASSIC_PATH_MAP, CLASSIC3_HOME_MAP),
+    BOARD_VARIANT("4人対戦 (クラシック)", classic4, CLASSIC4_COLORS, CLASSIC4_LAYOUT,
+                  CLASSIC4_BASE_MAP, CLASSIC_PATH_MAP, CLASSIC4_HOME_MAP),
+    BOARD_VARIANT("5人対戦", ring5, RING5_COLORS, RING5_LAYOUT,
+                  RING5_BASE_MAP, RING_PATH_MAP, RING5_HOME_MAP),
+    BOARD_VARIANT("6人対戦", ring6, RING6_COLORS, RING6_LAYOUT,
+                  RING6_BASE_MAP, RING_PATH_MAP, RING6_HOME_MAP),
+};
+#define NUM_BOARD_VARIANTS (int)(sizeof(BOARD_VARIANTS) / sizeof(BOARD_VARIANTS[0]))
+_Static_assert(NUM_BOARD_VARIANTS == MENU_ITEM_VARIANT_6P - MENU_ITEM_VARIANT_2P + 1,
+               "BOARD_VARIANTS does not match MENU_ITEM_VARIANT_2P..6P");
+
 // --- グローバル変数 ---
 MEVENT g_last_event;
 
 // --- 関数プロトタイプ宣言 ---
 void run();
-void startGame();
+void startGame(const BoardVariant *variant);
 void showMainMenu();
+const BoardVariant* showVariantMenu();
 void showRulesScreen();
 void showGameScreen(GameState *state);
 void showResultScreen(GameState *state);
@@ -106,7 +357,7 @@ void drawInputField(int y, int x, int width, const char* label, const char* cont
 void displayFileContent(const char *filepath);
 void displayError(const char *message);
 void initColors();
-Point getGridCoords(const Piece* piece, Player* player);
+Point getGridCoords(const BoardVariant *variant, const Piece* piece, Player* player);
 MenuSelection handleInput(MenuItem items[], int num_items,
                         int panel_x, int panel_y, int panel_h, int panel_w,
                         int board_x, int board_y, int board_h, int board_w);
@@ -115,8 +366,6 @@ void initializeNcurses();
 void cleanupNcurses();
 void addLog(GameState *state, const char* message);
 void nextTurn(GameState *state);
-int getHomeEntryPos(Player *p);
-int getAbsolutePos(int relative_pos, Player *player);
 void drawBox(int y, int x, int h, int w);
 const char* colorToString(CellColor color);
 int getDisplayWidth(const char* str);
@@ -137,18 +386,18 @@ void run() {
     }
 }
 
-void startGame() {
+void startGame(const BoardVariant *variant) {
     GameState state;
     memset(&state, 0, sizeof(GameState));
-    state.num_players = 4;
+    state.variant = variant;
+    state.num_players = variant->num_players;
     state.current_turn_idx = 0;
     state.phase = STATE_ROLLING;
 
-    CellColor colors[] = {C_RED, C_GREEN, C_YELLOW, C_BLUE};
     for (int i = 0; i < state.num_players; i++) {
         Player *p = &state.players[i];
         p->id = i + 1;
-        p->color = colors[i];
+        p->color = variant->seat_colors[i];
         p->is_active = true;
         for(int j = 0; j < 4; j++) {
             p->pieces[j].id = j;
@@ -159,26 +408,28 @@ void startGame() {
 
      // ▼▼▼【このブロックを丸ごと置き換える】▼▼▼
     #if DEBUG_MODE
-    // --- デバッグモード：3人がゴールした状態で開始 ---
+    // --- デバッグモード：最下位以外の全員がゴールした状態で開始 ---
     
-    // Player 1, 2, 3 をゴール済みの状態に設定します。
-    for (int i = 0; i < 3; i++) {
+    // 最後のプレイヤー以外をゴール済みの状態に設定します。
+    for (int i = 0; i < state.num_players - 1; i++) {
         Player *p = &state.players[i];
         p->pieces_at_goal = 4;
-        p->rank = i + 1; // 順位を1位、2位、3位に設定
+        p->rank = i + 1; // 順位を1位から順に設定
         for (int j = 0; j < 4; j++) {
             p->pieces[j].position = GOAL_POSITION;
         }
     }
 
-    // ゴールしたプレイヤーの合計数を3に設定
-    state.finished_players_count = 3;
+    // ゴールしたプレイヤーの合計数を設定
+    state.finished_players_count = state.num_players - 1;
 
     // ゲーム状態を「ゲームオーバー」に設定
     state.phase = STATE_GAME_OVER;
 
     // ログにデバッグモードであることを表示
-    addLog(&state, "!!! DEBUG: 3 players finished. !!!");
+    char debug_msg[50];
+    sprintf(debug_msg, "!!! DEBUG: %d players finished. !!!", state.num_players - 1);
+    addLog(&state, debug_msg);
     #endif
     // ▲▲▲【ここまで置き換え】▲▲▲
 
@@ -206,12 +457,42 @@ void showMainMenu() {
     while(1) {
         drawMenu(title, items, num_items);
         MenuSelection choice = handleInput(items, num_items, 0,0,0,0, 0,0,0,0);
-        if (choice == MENU_ITEM_START_GAME) { startGame(); return; }
+        if (choice == MENU_ITEM_START_GAME) {
+            const BoardVariant *variant = showVariantMenu();
+            if (variant != NULL) { startGame(variant); }
+            return;
+        }
         if (choice == MENU_ITEM_RULES) { showRulesScreen(); return; }
         if (choice == MENU_ITEM_EXIT) { shutdown(); }
     }
 }
 
+const BoardVariant* showVariantMenu() {
+    timeout(-1);
+    clear();
+    const char *title = "盤面を選択";
+    MenuItem items[NUM_BOARD_VARIANTS + 1];
+    for (int i = 0; i < NUM_BOARD_VARIANTS; i++) {
+        items[i] = (MenuItem){BOARD_VARIANTS[i].name, LINES / 2 - 5 + i * 2, 0, 1, 0,
+                              (MenuSelection)(MENU_ITEM_VARIANT_2P + i)};
+    }
+    items[NUM_BOARD_VARIANTS] = (MenuItem){"戻る", LINES / 2 - 5 + NUM_BOARD_VARIANTS * 2, 0, 1, 0, MENU_ITEM_BACK};
+    int num_items = NUM_BOARD_VARIANTS + 1;
+    for(int i = 0; i < num_items; i++) {
+        items[i].width = getDisplayWidth(items[i].text) + 4;
+        items[i].x = (COLS - items[i].width) / 2;
+    }
+
+    while(1) {
+        drawMenu(title, items, num_items);
+        MenuSelection choice = handleInput(items, num_items, 0,0,0,0, 0,0,0,0);
+        if (choice == MENU_ITEM_BACK) { return NULL; }
+        if (choice >= MENU_ITEM_VARIANT_2P && choice <= MENU_ITEM_VARIANT_6P) {
+            return &BOARD_VARIANTS[choice - MENU_ITEM_VARIANT_2P];
+        }
+    }
+}
+
 void showRulesScreen() {
     timeout(-1);
     clear();
@@ -225,7 +506,8 @@ void showRulesScreen() {
 
 void showGameScreen(GameState *state) {
     timeout(100);
-    int board_h = BOARD_H, board_w = BOARD_W, panel_w = 45;
+    const BoardVariant *variant = state->variant;
+    int board_h = variant->rows * CELL_H + 1, board_w = variant->cols * CELL_W + 1, panel_w = 45;
     int total_w = board_w + panel_w;
     int start_y = (LINES - board_h) / 2;
     int start_x = (COLS - total_w) / 2;
@@ -281,14 +563,8 @@ void showGameScreen(GameState *state) {
                 bool can_move = false;
                 for (int i = 0; i < 4; i++) {
                     Piece *p = &current_player->pieces[i];
-                    p->is_movable = false;
-                    if (p->position == GOAL_POSITION) continue;
-                    if ((p->position == -1 && state->dice_value == 6) ||
-                        (p->position >= 100 && (p->position % 100 + state->dice_value <= HOME_STRETCH_LENGTH)) ||
-                        (p->position >= 0 && p->position < PATH_LENGTH)) {
-                        p->is_movable = true;
-                        can_move = true;
-                    }
+                    p->is_movable = variant->isMovable(p->position, state->dice_value);
+                    if (p->is_movable) { can_move = true; }
                 }
                 if (can_move) {
                     addLog(state, "動かす駒をクリックしてください。");
@@ -302,8 +578,8 @@ void showGameScreen(GameState *state) {
         } else if (choice == BOARD_CLICK) {
             if (state->phase == STATE_MOVING_PIECE) {
                 MEVENT event = g_last_event;
-                int clicked_grid_y = (event.y - start_y - 1 ) / 2;
-                int clicked_grid_x = (event.x - start_x - 1) / 5;
+                int clicked_grid_y = (event.y - start_y - 1) / CELL_H;
+                int clicked_grid_x = (event.x - start_x - 1) / CELL_W;
                 FILE *fp = fopen("debug3.log", "a");
                 if(fp){
                     fprintf(fp,"event.y: %d, event.x: %d\n", event.y, event.x);
@@ -313,13 +589,13 @@ void showGameScreen(GameState *state) {
                 for (int i = 0; i < 4; i++) {
                     Piece *p = &current_player->pieces[i];
                     if (!p->is_movable) continue;
-                    Point grid_coords = getGridCoords(p, current_player);
+                    Point grid_coords = getGridCoords(variant, p, current_player);
                     int click_y = event.y;
                     int click_x = event.x;
                     if (fp) {
                         fprintf(fp, "Piece %d grid: (%d, %d)\n", i, grid_coords.y, grid_coords.x);
                     }
-                    if ((clicked_grid_x <= grid_coords.x + 1.8 && clicked_grid_x >= grid_coords.x - 1.8) && clicked_grid_y == grid_coords.y) {
+                    if (clicked_grid_x == grid_coords.x && clicked_grid_y == grid_coords.y) {
                         if (fp) {
                         // 駒クリック判定
                         handlePieceMove(state, p);
@@ -355,47 +631,31 @@ void showResultScreen(GameState *state) {
 }
 
 void handlePieceMove(GameState *state, Piece *clicked_piece) {
+    const BoardVariant *variant = state->variant;
     Player* current_player = &state->players[state->current_turn_idx];
-    int dice = state->dice_value;
-
-    if (clicked_piece->position == -1) { clicked_piece->position = 0; }
-    else if (clicked_piece->position >= 100) {
-        int home_pos = clicked_piece->position % 100;
-        if (home_pos + dice == HOME_STRETCH_LENGTH) {
-            clicked_piece->position = GOAL_POSITION;
-            current_player->pieces_at_goal++;
-            addLog(state, "駒がゴールしました！");
-            if (current_player->pieces_at_goal == 4) {
-                current_player->rank = ++state->finished_players_count;
-                addLog(state, "全駒がゴール！");
-                if (state->finished_players_count >= state->num_players - 1) {
-                    state->phase = STATE_GAME_OVER;
-                }
-            }
-        } else { clicked_piece->position += dice; }
-    }
-    else {
-        int home_entry = getHomeEntryPos(current_player);
-        if (clicked_piece->position <= home_entry && clicked_piece->position + dice > home_entry) {
-            int to_home = home_entry - clicked_piece->position + 1;
-            int remaining_move = dice - to_home;
-            if (remaining_move < HOME_STRETCH_LENGTH) {
-                clicked_piece->position = 100 + remaining_move;
+
+    clicked_piece->position = variant->advance(clicked_piece->position, state->dice_value);
+    if (clicked_piece->position == GOAL_POSITION) {
+        current_player->pieces_at_goal++;
+        addLog(state, "駒がゴールしました！");
+        if (current_player->pieces_at_goal == 4) {
+            current_player->rank = ++state->finished_players_count;
+            addLog(state, "全駒がゴール！");
+            if (state->finished_players_count >= state->num_players - 1) {
+                state->phase = STATE_GAME_OVER;
             }
-        } else {
-            clicked_piece->position = (clicked_piece->position + dice) % PATH_LENGTH;
         }
     }
 
     if (clicked_piece->position < 100) {
-        int target_abs_pos = getAbsolutePos(clicked_piece->position, current_player);
+        int target_abs_pos = variant->absolutePos(clicked_piece->position, state->current_turn_idx);
         for (int i = 0; i < state->num_players; i++) {
             if (i == state->current_turn_idx) continue;
             Player* other_player = &state->players[i];
             for (int j = 0; j < 4; j++) {
                 Piece* other_piece = &other_player->pieces[j];
                 if (other_piece->position < 0 || other_piece->position >= 100) continue;
-                if (target_abs_pos == getAbsolutePos(other_piece->position, other_player)) {
+                if (target_abs_pos == variant->absolutePos(other_piece->position, i)) {
                     other_piece->position = -1;
                     char log_msg[100];
                     sprintf(log_msg, "Player %d の駒をベースに戻した！", other_player->id);
@@ -408,46 +668,27 @@ void handlePieceMove(GameState *state, Piece *clicked_piece) {
 }
 
 void drawBoard(GameState *state, int base_y, int base_x) {
-    static const int board_layout[15][15] = {
-        {1,1,1,1,1,1, 5,5,5, 2,2,2,2,2,2},
-        {1,1,0,0,1,1, 5,2,5, 2,2,0,0,2,2},
-        {1,0,1,1,0,1, 5,2,5, 2,0,2,2,0,2},
-        {1,0,1,1,0,1, 5,2,5, 2,0,2,2,0,2},
-        {1,1,0,0,1,1, 5,2,5, 2,2,0,0,2,2},
-        {1,1,1,1,1,1, 5,2,5, 2,2,2,2,2,2},
-        {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
-        {5,1,1,1,1,1, 6,6,6, 3,3,3,3,3,5},
-        {5,5,5,5,5,5, 5,6,5, 5,5,5,5,5,5},
-        {4,4,4,4,4,4, 5,4,5, 3,3,3,3,3,3},
-        {4,4,0,0,4,4, 5,4,5, 3,3,0,0,3,3},
-        {4,0,4,4,0,4, 5,4,5, 3,0,3,3,0,3},
-        {4,0,4,4,0,4, 5,4,5, 3,0,3,3,0,3},
-        {4,4,0,0,4,4, 5,4,5, 3,3,0,0,3,3},
-        {4,4,4,4,4,4, 5,5,5, 3,3,3,3,3,3},
-    };
-    for (int r=0; r<15; r++) for (int c=0; c<15; c++) {
-        int color = board_layout[r][c];
-        if (color == 0) {
-            if (r<7 && c<7) color=1; else if (r<7 && c>7) color=2;
-            else if (r>7 && c>7) color=3; else color=4;
-        }
+    const BoardVariant *variant = state->variant;
+    int board_h = variant->rows * CELL_H + 1, board_w = variant->cols * CELL_W + 1;
+    for (int r=0; r<variant->rows; r++) for (int c=0; c<variant->cols; c++) {
+        int color = variant->layout[r * variant->cols + c];
         attron(COLOR_PAIR(color));
-        mvprintw(base_y+r*2+1, base_x+c*4+1, "    ");
-        mvprintw(base_y+r*2+2, base_x+c*4+1, "    ");
+        mvprintw(base_y+r*CELL_H+1, base_x+c*CELL_W+1, "    ");
+        mvprintw(base_y+r*CELL_H+2, base_x+c*CELL_W+1, "    ");
         attroff(COLOR_PAIR(color));
     }
     attron(COLOR_PAIR(C_GRID));
-    for (int r=0; r<=15; r++) { mvhline(base_y+r*2, base_x, 0, BOARD_W); }
-    for (int c=0; c<=15; c++) { mvvline(base_y, base_x+c*4, 0, BOARD_H); }
+    for (int r=0; r<=variant->rows; r++) { mvhline(base_y+r*CELL_H, base_x, 0, board_w); }
+    for (int c=0; c<=variant->cols; c++) { mvvline(base_y, base_x+c*CELL_W, 0, board_h); }
     attroff(COLOR_PAIR(C_GRID));
 
     for(int i=0; i<state->num_players; i++) {
         Player* p = &state->players[i];
         for(int j=0; j<4; j++) {
             if (p->pieces[j].position != GOAL_POSITION) {
-                Point grid_coords = getGridCoords(&p->pieces[j], p);
-                int piece_y = base_y + grid_coords.y*2 + 1;
-                int piece_x = base_x + grid_coords.x*4 + 1;
+                Point grid_coords = getGridCoords(variant, &p->pieces[j], p);
+                int piece_y = base_y + grid_coords.y*CELL_H + 1;
+                int piece_x = base_x + grid_coords.x*CELL_W + 1;
                 // デバッグ用ログ
                 //FILE *fp = fopen("debug.log", "a");
                 //if (fp) {
@@ -490,45 +731,14 @@ void addLog(GameState *state, const char* message) {
     snprintf(state->message_log[4], 100, "%s", message);
 }
 
-Point getGridCoords(const Piece* piece, Player* player) {
-    static const Point base_map[4][4] = {
-        {{1,1},{1,4},{4,1},{4,4}}, {{1,10},{1,13},{4,10},{4,13}},
-        {{10,10},{10,13},{13,10},{13,13}}, {{10,1},{10,4},{13,1},{13,4}}
-    };
-    static const Point path_map[52] = {
-        {6,1},{6,2},{6,3},{6,4},{6,5}, {5,6},{4,6},{3,6},{2,6},{1,6},{0,6},
-        {0,7}, {0,8},{1,8},{2,8},{3,8},{4,8},{5,8}, {6,9},{6,10},{6,11},{6,12},{6,13},{6,14},
-        {7,14}, {8,14},{8,13},{8,12},{8,11},{8,10},{8,9}, {9,8},{10,8},{11,8},{12,8},{13,8},{14,8},
-        {14,7}, {14,6},{13,6},{12,6},{11,6},{10,6},{9,6}, {8,5},{8,4},{8,3},{8,2},{8,1},{8,0},
-        {7,0}, {6,0}
-    };
-    static const Point home_map[4][6] = {
-        {{7,1},{7,2},{7,3},{7,4},{7,5},{7,6}}, {{1,7},{2,7},{3,7},{4,7},{5,7},{6,7}},
-        {{7,13},{7,12},{7,11},{7,10},{7,9},{7,8}}, {{13,7},{12,7},{11,7},{10,7},{9,7},{8,7}}
-    };
-    if (piece->position == -1) { return base_map[player->color-1][piece->id]; }
-    if (piece->position >= 100) { return home_map[player->color-1][piece->position % 100]; }
-    if (piece->position >= 0) { return path_map[getAbsolutePos(piece->position, player)]; }
-    return (Point){-1,-1};
-}
-
-int getHomeEntryPos(Player *p) {
-    switch (p->color) {
-        case C_RED:    return 50; case C_GREEN:  return 11;
-        case C_YELLOW: return 24; case C_BLUE:   return 37;
-        default:       return -1;
+Point getGridCoords(const BoardVariant *variant, const Piece* piece, Player* player) {
+    int seat = player->id - 1;
+    if (piece->position == -1) { return variant->base_map[seat][piece->id]; }
+    if (piece->position >= 100) {
+        return variant->home_map[seat * variant->home_stretch_length + piece->position % 100];
     }
-}
-
-int getAbsolutePos(int relative_pos, Player *player) {
-    int start_pos = 0;
-    switch(player->color){
-        case C_GREEN: start_pos = 13; break;
-        case C_YELLOW: start_pos = 26; break;
-        case C_BLUE: start_pos = 39; break;
-        default: break;
-    }
-    return (relative_pos + start_pos) % PATH_LENGTH;
+    if (piece->position >= 0) { return variant->path_map[variant->absolutePos(piece->position, seat)]; }
+    return (Point){-1,-1};
 }
 
 void initColors() {
@@ -537,6 +747,7 @@ void initColors() {
     init_pair(C_YELLOW, COLOR_WHITE, COLOR_YELLOW); init_pair(C_BLUE, COLOR_WHITE, COLOR_BLUE);
     init_pair(C_PATH, COLOR_BLACK, COLOR_WHITE); init_pair(C_GOAL, COLOR_BLACK, COLOR_MAGENTA);
     init_pair(C_GRID, COLOR_BLACK, -1); init_pair(C_PANEL_BG, COLOR_WHITE, COLOR_BLACK);
+    init_pair(C_CYAN, COLOR_WHITE, COLOR_CYAN); init_pair(C_MAGENTA, COLOR_WHITE, COLOR_MAGENTA);
 }
 
 MenuSelection handleInput(MenuItem items[], int num_items,
@@ -622,7 +833,7 @@ void displayError(const char *message) {
 }
 
 const char* colorToString(CellColor color) {
-    switch(color) { case C_RED:return"Red"; case C_GREEN:return"Green"; case C_YELLOW:return"Yellow"; case C_BLUE:return"Blue"; default:return"None"; }
+    switch(color) { case C_RED:return"Red"; case C_GREEN:return"Green"; case C_YELLOW:return"Yellow"; case C_BLUE:return"Blue"; case C_CYAN:return"Cyan"; case C_MAGENTA:return"Magenta"; default:return"None"; }
 }
 
 int getDisplayWidth(const char* str) {